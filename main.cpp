@@ -46,6 +46,16 @@
 #include <array>
 #include <vector>
 #include <random>
+#include <chrono>
+#include <numeric>
+#include <queue>
+#include <functional>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cmath>
+#include <thread>
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
@@ -64,62 +74,177 @@ void print(T t, bool isLine=true) {
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-// http://dx.doi.org/10.18637/jss.v008.i14
-class RandomGenerator {
-    unsigned int w, x, y, z;
-public:
-    RandomGenerator(unsigned int seed = 88675123U);
-private:
-    unsigned int getSeed();
-    unsigned int xOrShift();
-public:
-    float getRandom(unsigned int max=100000);
-    unsigned int getRandomRange(int min, int max);
-};
-RandomGenerator::RandomGenerator(unsigned int seed) : w(seed) {
-    x = 123456789U;
-    y = 362436069U;
-    z = 521288629U;
-}
-unsigned int RandomGenerator::getSeed(){
+// 乱数生成器（コンパイル時に選ぶポリシー）。
+// どれも next() で32bitの乱数を返す。仮想関数は使わないので，FGOGacha::rollOne からはインライン展開される。
+// 選び方: cmake -DGACHA_RANDOM=Pcg64 など（既定は Xoshiro256StarStar）。
+
+unsigned long long getClockSeed() {
     // create seed from current time
     auto n = std::chrono::high_resolution_clock::now();
     auto d = n - n.min();
-    // https://stackoverflow.com/questions/12031302/convert-from-long-long-to-int-and-the-other-way-back-in-c
-    // https://stackoverflow.com/questions/4975340/int-to-unsigned-int-conversion
-    unsigned int s = (unsigned int) std::chrono::duration_cast<std::chrono::microseconds>(d).count();
-    return s;
+    return (unsigned long long)std::chrono::duration_cast<std::chrono::microseconds>(d).count();
 }
-unsigned int RandomGenerator::xOrShift() {
-    w = getSeed();
-    unsigned int t = x ^ (x << 11);
-    x = y;
-    y = z;
-    w = (w ^ (w >> 19)) ^ (t ^ (t >> 8));
-    return w;
+unsigned long long splitMix64(unsigned long long &x) {
+    // シード展開用
+    // http://prng.di.unimi.it/splitmix64.c
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
 }
-unsigned int RandomGenerator::getRandomRange(int min, int max) {
-    unsigned int value = xOrShift();
-    return min + value % (max - min);
+template <typename Random>
+unsigned int getRandomRange(Random &random, const unsigned int max) {
+    // [0, max) の一様乱数（除算なし）
+    return (unsigned int)(((unsigned long long)random.next() * max) >> 32);
 }
-float RandomGenerator::getRandom(unsigned int max) {
-    // 少数第3位まで
 
-    // http://vivi.dyndns.org/tech/cpp/random.html
-    std::random_device rnd;     // 非決定的な乱数生成器を生成
-    std::mt19937 mt(rnd());     //  メルセンヌ・ツイスタの32ビット版、引数は初期シード値
-    std::uniform_int_distribution<> rand100(0, max-1);        // [0, 99] 範囲の一様乱数
-    float r = (float)rand100(mt)/1000.0f;
+// http://dx.doi.org/10.18637/jss.v008.i14
+class XorShift128 {
+    unsigned int x, y, z, w;
+public:
+    XorShift128(unsigned long long seed = 88675123U) {
+        unsigned long long s = seed;
+        unsigned long long a = splitMix64(s), b = splitMix64(s);
+        x = (unsigned int)a; y = (unsigned int)(a >> 32);
+        z = (unsigned int)b; w = (unsigned int)(b >> 32);
+        if ((x | y | z | w) == 0) {
+            w = 88675123U;
+        }
+    }
+    static const char *getName() { return "xorshift128"; }
+    unsigned int next() {
+        unsigned int t = x ^ (x << 11);
+        x = y;
+        y = z;
+        z = w;
+        w = (w ^ (w >> 19)) ^ (t ^ (t >> 8));
+        return w;
+    }
+};
 
-    return r;
-}
+// http://prng.di.unimi.it/xoshiro256starstar.c
+class Xoshiro256StarStar {
+    unsigned long long s[4];
+    static unsigned long long rotl(const unsigned long long x, const int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+public:
+    Xoshiro256StarStar(unsigned long long seed = 88675123U) {
+        for (unsigned long long &x : s) {
+            x = splitMix64(seed);
+        }
+    }
+    static const char *getName() { return "xoshiro256**"; }
+    unsigned int next() {
+        const unsigned long long r = rotl(s[1] * 5, 7) * 9;
+        const unsigned long long t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        // 上位32bitを使う
+        return (unsigned int)(r >> 32);
+    }
+};
+
+// 128bit整数が使える環境（GCC, Clangの64bit）のみ
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 Uint128;
+
+// http://www.pcg-random.org/ (pcg64: XSL RR 128/64)
+class Pcg64 {
+    Uint128 m_state;
+    Uint128 m_inc;
+    void step() {
+        const Uint128 mul = ((Uint128)0x2360ED051FC65DA4ULL << 64) | 0x4385DF649FCCF645ULL;
+        m_state = m_state * mul + m_inc;
+    }
+public:
+    Pcg64(unsigned long long seed = 88675123U) {
+        unsigned long long a = splitMix64(seed), b = splitMix64(seed), c = splitMix64(seed);
+        m_state = 0;
+        m_inc = (((Uint128)c << 64 | b) << 1) | 1;
+        step();
+        m_state += ((Uint128)a << 64) | splitMix64(seed);
+        step();
+    }
+    static const char *getName() { return "pcg64"; }
+    unsigned int next() {
+        step();
+        const unsigned long long x = (unsigned long long)(m_state >> 64) ^ (unsigned long long)m_state;
+        const unsigned int rot = (unsigned int)(m_state >> 122);
+        const unsigned long long r = (x >> rot) | (x << ((64 - rot) & 63));
+        // 上位32bitを使う
+        return (unsigned int)(r >> 32);
+    }
+};
+#endif
+
+// Salmon et al., "Parallel random numbers: as easy as 1, 2, 3" (SC11)
+// カウンタ(128bit)と鍵(64bit)から4語ずつ生成する。
+class Philox4x32 {
+    unsigned int m_counter[4];
+    unsigned int m_key[2];
+    unsigned int m_buffer[4];
+    unsigned int m_index;
+    static void mulHiLo(const unsigned int a, const unsigned int b, unsigned int &hi, unsigned int &lo) {
+        const unsigned long long p = (unsigned long long)a * b;
+        hi = (unsigned int)(p >> 32);
+        lo = (unsigned int)p;
+    }
+    void generate() {
+        unsigned int c0 = m_counter[0], c1 = m_counter[1], c2 = m_counter[2], c3 = m_counter[3];
+        unsigned int k0 = m_key[0], k1 = m_key[1];
+        for (int round = 0; round < 10; ++round) {
+            unsigned int hi0, lo0, hi1, lo1;
+            mulHiLo(0xD2511F53U, c0, hi0, lo0);
+            mulHiLo(0xCD9E8D57U, c2, hi1, lo1);
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9U;
+            k1 += 0xBB67AE85U;
+        }
+        m_buffer[0] = c0; m_buffer[1] = c1; m_buffer[2] = c2; m_buffer[3] = c3;
+
+        // カウンタを進める
+        for (unsigned int &c : m_counter) {
+            if (++c != 0) {
+                break;
+            }
+        }
+    }
+public:
+    Philox4x32(unsigned long long seed = 88675123U) : m_counter{0, 0, 0, 0}, m_index(4) {
+        unsigned long long k = splitMix64(seed);
+        m_key[0] = (unsigned int)k;
+        m_key[1] = (unsigned int)(k >> 32);
+    }
+    static const char *getName() { return "philox4x32-10"; }
+    unsigned int next() {
+        if (m_index == 4) {
+            generate();
+            m_index = 0;
+        }
+        return m_buffer[m_index++];
+    }
+};
+
+#ifndef GACHA_RANDOM
+#define GACHA_RANDOM Xoshiro256StarStar
+#endif
+typedef GACHA_RANDOM DefaultRandom;
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 // http://vivi.dyndns.org/tech/cpp/timeMeasurement.html
-class FGOGacha {
-    // 乱数テーブル
-    RandomGenerator m_randomizer;
+template <typename Random>
+class BasicFGOGacha {
+    // 乱数生成器
+    Random m_randomizer;
     // 課金石名称
     std::string StoneName = "聖晶石";
     // ガチャ内容
@@ -131,7 +256,8 @@ class FGOGacha {
 private:
     void setParameters();
 public:
-    FGOGacha();
+    BasicFGOGacha();
+    BasicFGOGacha(bool isPickUp);
     void changePickUpState(bool isPickUp);
     std::string getStoneName();
     unsigned int getStoneConsumption(unsigned int numOfGacha);
@@ -139,7 +265,10 @@ public:
 // MARK: FGOGacha::public methods
 public:
     std::vector<unsigned int> roll(unsigned int trials);
+    std::array<float, 100> getProb();
     std::array<std::string, 100> getProbName();
+    std::array<float, 100> getReLotteryCraftEssenceProb();
+    std::array<float, 100> getReLotteryServantProb();
     unsigned int getArrayNum();
 // MARK: FGOGacha::private methods
 private:
@@ -151,9 +280,11 @@ private:
     unsigned int reLotteryServant();
     bool checkSumPercentage(std::array<float, 100> prob);
 };
+typedef BasicFGOGacha<DefaultRandom> FGOGacha;
 
 // MARK: FGOGacha::static method
-void FGOGacha::setParameters() {
+template <typename Random>
+void BasicFGOGacha<Random>::setParameters() {
     // init a rarity percentage array ------
     std::fill(m_prob.begin(), m_prob.end(), 0);
     std::fill(m_prob_name.begin(), m_prob_name.end(), "");
@@ -189,20 +320,24 @@ void FGOGacha::setParameters() {
         };
     }
 }
-void FGOGacha::changePickUpState(const bool isPickUp) {
+template <typename Random>
+void BasicFGOGacha<Random>::changePickUpState(const bool isPickUp) {
     m_isPickUp = isPickUp;
     setParameters();
     std::string s = (isPickUp ? "True" : "False");
     print("FGO ピックアップ状態が \""+s+"\"" + "に変更されました。");
 }
-std::string FGOGacha::getStoneName() {
+template <typename Random>
+std::string BasicFGOGacha<Random>::getStoneName() {
     return StoneName;
 }
-unsigned int FGOGacha::getStoneConsumption(const unsigned int numOfGacha) {
+template <typename Random>
+unsigned int BasicFGOGacha<Random>::getStoneConsumption(const unsigned int numOfGacha) {
     // https://game8.jp/fate-go/144558
     return numOfGacha*3;
 }
-unsigned int FGOGacha::getStoneFee(const unsigned int numOfStones) {
+template <typename Random>
+unsigned int BasicFGOGacha<Random>::getStoneFee(const unsigned int numOfStones) {
     // https://game8.jp/fate-go/144558
 //    聖晶石の個数	金額	1個毎
 //    167個	9,800円	58円
@@ -217,15 +352,23 @@ unsigned int FGOGacha::getStoneFee(const unsigned int numOfStones) {
 }
 
 // MARK: FGOGacha::init
-FGOGacha::FGOGacha() {
+template <typename Random>
+BasicFGOGacha<Random>::BasicFGOGacha() {
     // init a randomizer
-    m_randomizer = RandomGenerator();
+    m_randomizer = Random(getClockSeed());
 
     setParameters();
 }
+template <typename Random>
+BasicFGOGacha<Random>::BasicFGOGacha(const bool isPickUp)
+        : m_randomizer(getClockSeed()), m_isPickUp(isPickUp) {
+    // ピックアップ状態を指定して初期化する（表示なし）。
+    setParameters();
+}
 
 // MARK: FGOGacha::UseCases
-std::vector<unsigned int> FGOGacha::roll(const unsigned int trials) {
+template <typename Random>
+std::vector<unsigned int> BasicFGOGacha<Random>::roll(const unsigned int trials) {
     // variables
     std::vector<unsigned int> history;
 
@@ -278,16 +421,49 @@ std::vector<unsigned int> FGOGacha::roll(const unsigned int trials) {
 
     return history;
 }
-std::array<std::string, 100> FGOGacha::getProbName() {
+template <typename Random>
+std::array<float, 100> BasicFGOGacha<Random>::getProb() {
+    return m_prob;
+}
+template <typename Random>
+std::array<std::string, 100> BasicFGOGacha<Random>::getProbName() {
     return m_prob_name;
 };
+template <typename Random>
+std::array<float, 100> BasicFGOGacha<Random>::getReLotteryCraftEssenceProb() {
+    // 礼装☆4が92.0%になる再抽選テーブル。
+    std::array<float, 100> re_prob;
+    if (m_isPickUp) {
+        re_prob = {0.5, 0.5, 1.5, 1.5, 0.0,
+                   2.0, 2.0, 46.0, 46.0, 0.0};
+    }else{
+        re_prob = {1.0, 3.0, 0.0,
+                   4.0, 92.0, 0.0};
+    }
+    return re_prob;
+}
+template <typename Random>
+std::array<float, 100> BasicFGOGacha<Random>::getReLotteryServantProb() {
+    // ☆3鯖が96.0%になる再抽選テーブル。
+    std::array<float, 100> re_prob;
+    if (m_isPickUp) {
+        re_prob = {0.5, 0.5, 1.5, 1.5, 96.0,
+                   0.0, 0.0, 0.0, 0.0, 0.0};
+    }else{
+        re_prob = {1.0, 3.0, 96.0,
+                   0.0, 0.0, 0.0};
+    }
+    return re_prob;
+}
 
 // MARK: FGOGacha::Model
-float FGOGacha::getRandom(const unsigned int max) {
+template <typename Random>
+float BasicFGOGacha<Random>::getRandom(const unsigned int max) {
     //小数第3位まで(ab.cde)
-    return m_randomizer.getRandom();
+    return (float)getRandomRange(m_randomizer, max)/1000.0f;
 }
-bool FGOGacha::checkSumPercentage(std::array<float, 100> prob) {
+template <typename Random>
+bool BasicFGOGacha<Random>::checkSumPercentage(std::array<float, 100> prob) {
     // ガチャの確率が100%かどうか判断する。
     float sum = 0;
     // http://vivi.dyndns.org/tech/cpp/range-for.html
@@ -296,7 +472,8 @@ bool FGOGacha::checkSumPercentage(std::array<float, 100> prob) {
     }
     return 100.0 == sum;
 }
-unsigned int FGOGacha::rollOne(std::array<float, 100> prob) {
+template <typename Random>
+unsigned int BasicFGOGacha<Random>::rollOne(std::array<float, 100> prob) {
     // ガチャを引く。返り値nは配列のn番目。
 
     // Get random value(0 to 100)
@@ -322,7 +499,8 @@ unsigned int FGOGacha::rollOne(std::array<float, 100> prob) {
     std::cout << "Could not pick gacha contents!" << std::endl;
     return 0;
 }
-bool FGOGacha::decisionPickRareCards(std::vector<unsigned int> history) {
+template <typename Random>
+bool BasicFGOGacha<Random>::decisionPickRareCards(std::vector<unsigned int> history) {
     // 全て☆3であったかを確認する。
     for (unsigned int i = 0; i != history.size(); ++i) {
         // 3の文字が見つかればtrueを返す。
@@ -332,59 +510,49 @@ bool FGOGacha::decisionPickRareCards(std::vector<unsigned int> history) {
     }
     return false;
 }
-bool FGOGacha::decisionPickServant(std::vector<unsigned int> history) {
+template <typename Random>
+bool BasicFGOGacha<Random>::decisionPickServant(std::vector<unsigned int> history) {
     // 全て概念礼装であったかを確認する。
     for (unsigned int i = 0; i != history.size(); ++i) {
-        // 3の文字が見つかればtrueを返す。
-        if ((int)m_prob_name.at(history.at(i)).find("鯖") == -1) {
+        // 鯖の文字が見つかればtrueを返す。
+        if ((int)m_prob_name.at(history.at(i)).find("鯖") != -1) {
             return true;
         }
     }
     return false;
 }
-unsigned int FGOGacha::reLotteryCraftEssence(){
+template <typename Random>
+unsigned int BasicFGOGacha<Random>::reLotteryCraftEssence(){
     // ☆4の再抽選。方法は
     // http://oudoon.blog.fc2.com/blog-entry-17.html
     // を参考に，
     // 礼装☆4が92.0%になるとする。
     print("10連救済措置：☆4再抽選!");
 
-    std::array<float, 100> re_prob;
-    if (m_isPickUp) {
-        re_prob = {0.5, 0.5, 1.5, 1.5, 0.0,
-                   2.0, 2.0, 46.0, 46.0, 0.0};
-    }else{
-        re_prob = {1.0, 3.0, 0.0,
-                   4.0, 92.0, 0.0};
-    }
+    std::array<float, 100> re_prob = getReLotteryCraftEssenceProb();
     if (!checkSumPercentage(re_prob)) {
         std::cout << "[reLotteryCraftEssence] No match gacha percentage!" << std::endl;
         return 0;
     }
     return rollOne(re_prob);
 }
-unsigned int FGOGacha::reLotteryServant() {
+template <typename Random>
+unsigned int BasicFGOGacha<Random>::reLotteryServant() {
     // ☆3鯖の再抽選。方法は
     // http://oudoon.blog.fc2.com/blog-entry-17.html
     // を参考に，
     // ☆3鯖が96.0%になるとする。
     print("10連救済措置：☆3鯖再抽選!");
 
-    std::array<float, 100> re_prob;
-    if (m_isPickUp) {
-        re_prob = {0.5, 0.5, 1.5, 1.5, 96.0,
-                   0.0, 0.0, 0.0, 0.0, 0.0};
-    }else{
-        re_prob = {1.0, 3.0, 96.0,
-                   0.0, 0.0, 0.0};
-    }
+    std::array<float, 100> re_prob = getReLotteryServantProb();
     if (!checkSumPercentage(re_prob)) {
         std::cout << "[reLotteryServant] No match gacha percentage!" << std::endl;
         return 0;
     }
     return rollOne(re_prob);
 }
-unsigned int FGOGacha::getArrayNum() {
+template <typename Random>
+unsigned int BasicFGOGacha<Random>::getArrayNum() {
     unsigned int r = 0;
     for (std::string x : m_prob_name) {
         if (x == "") {
@@ -397,6 +565,674 @@ unsigned int FGOGacha::getArrayNum() {
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+// シーズン単位のガチャ計画シミュレーション。
+// バナー（ガチャ）の開催と石の配布をイベントとして日付順に処理する。
+// 同じバナーを引くプレイヤーはまとめて一括で抽選する。
+
+class GachaBanner {
+    // バナー名称
+    std::string m_title;
+    // 開催日（シーズン開始からの日数）
+    unsigned int m_day;
+    // 抽選テーブル（累積値, 0~100000）
+    std::array<unsigned int, 100> m_threshold;
+    std::array<unsigned int, 100> m_re_rare_threshold;
+    std::array<unsigned int, 100> m_re_servant_threshold;
+    std::array<std::string, 100> m_prob_name;
+    unsigned int m_num;
+    // 狙いの枠
+    unsigned int m_target_slot;
+    // 枠ごとの☆4以上，鯖の判定
+    std::array<bool, 100> m_is_rare;
+    std::array<bool, 100> m_is_servant;
+// MARK: GachaBanner::init
+public:
+    GachaBanner(std::string title, unsigned int day, FGOGacha gacha, unsigned int targetSlot=0);
+    GachaBanner(std::string title, unsigned int day,
+                std::array<float, 100> prob, std::array<std::string, 100> probName,
+                std::array<float, 100> reRareProb, std::array<float, 100> reServantProb,
+                unsigned int targetSlot=0);
+private:
+    std::array<unsigned int, 100> makeThreshold(std::array<float, 100> prob);
+// MARK: GachaBanner::public methods
+public:
+    std::string getTitle() const;
+    unsigned int getDay() const;
+    unsigned int getArrayNum() const;
+    unsigned int getTargetSlot() const;
+    std::string getProbName(unsigned int slot) const;
+    unsigned int pick(unsigned int v) const;
+    unsigned int pickReLotteryCraftEssence(unsigned int v) const;
+    unsigned int pickReLotteryServant(unsigned int v) const;
+    bool isRare(unsigned int slot) const;
+    bool isServant(unsigned int slot) const;
+    double getProbability(unsigned int slot) const;
+private:
+    unsigned int pick(const std::array<unsigned int, 100> &threshold, unsigned int v) const;
+};
+
+// MARK: GachaBanner::init
+GachaBanner::GachaBanner(const std::string title, const unsigned int day, FGOGacha gacha,
+                         const unsigned int targetSlot)
+        : GachaBanner(title, day, gacha.getProb(), gacha.getProbName(),
+                      gacha.getReLotteryCraftEssenceProb(), gacha.getReLotteryServantProb(), targetSlot) {
+}
+GachaBanner::GachaBanner(const std::string title, const unsigned int day,
+                         const std::array<float, 100> prob, const std::array<std::string, 100> probName,
+                         const std::array<float, 100> reRareProb, const std::array<float, 100> reServantProb,
+                         const unsigned int targetSlot)
+        : m_title(title), m_day(day), m_prob_name(probName), m_target_slot(targetSlot) {
+    m_threshold = makeThreshold(prob);
+    m_re_rare_threshold = makeThreshold(reRareProb);
+    m_re_servant_threshold = makeThreshold(reServantProb);
+
+    // 枠数を数える
+    m_num = 0;
+    for (std::string x : m_prob_name) {
+        if (x == "") {
+            break;
+        }
+        m_num += 1;
+    }
+    if (m_target_slot >= m_num) {
+        std::cout << "[GachaBanner] Target slot is out of range!" << std::endl;
+        m_target_slot = 0;
+    }
+
+    // FGOGacha::decisionPickRareCards, decisionPickServant と同じ判定
+    for (unsigned int i = 0; i < m_prob_name.size(); ++i) {
+        m_is_rare.at(i) = (int)m_prob_name.at(i).find("☆3") == -1;
+        m_is_servant.at(i) = (int)m_prob_name.at(i).find("鯖") != -1;
+    }
+}
+std::array<unsigned int, 100> GachaBanner::makeThreshold(const std::array<float, 100> prob) {
+    // 確率(%, 小数第3位まで)を0~100000の累積値に変換する。
+    std::array<unsigned int, 100> r;
+    unsigned int sum = 0;
+    for (unsigned int i = 0; i < prob.size(); ++i) {
+        sum += (unsigned int)(prob.at(i)*1000.0f + 0.5f);
+        r.at(i) = sum;
+    }
+    if (sum != 100000) {
+        std::cout << "[GachaBanner] No match gacha percentage!" << std::endl;
+    }
+    return r;
+}
+
+// MARK: GachaBanner::public methods
+std::string GachaBanner::getTitle() const {
+    return m_title;
+}
+unsigned int GachaBanner::getDay() const {
+    return m_day;
+}
+unsigned int GachaBanner::getArrayNum() const {
+    return m_num;
+}
+unsigned int GachaBanner::getTargetSlot() const {
+    // 狙いの枠（既定は先頭の鯖☆5(ﾋﾟｯｸｱｯﾌﾟ)，恒常なら鯖☆5）
+    return m_target_slot;
+}
+std::string GachaBanner::getProbName(const unsigned int slot) const {
+    return m_prob_name.at(slot);
+}
+unsigned int GachaBanner::pick(const unsigned int v) const {
+    return pick(m_threshold, v);
+}
+unsigned int GachaBanner::pickReLotteryCraftEssence(const unsigned int v) const {
+    return pick(m_re_rare_threshold, v);
+}
+unsigned int GachaBanner::pickReLotteryServant(const unsigned int v) const {
+    return pick(m_re_servant_threshold, v);
+}
+bool GachaBanner::isRare(const unsigned int slot) const {
+    return m_is_rare[slot];
+}
+bool GachaBanner::isServant(const unsigned int slot) const {
+    return m_is_servant[slot];
+}
+double GachaBanner::getProbability(const unsigned int slot) const {
+    // 枠の出現確率(0~1)
+    unsigned int prev = slot == 0 ? 0 : m_threshold.at(slot - 1);
+    return (m_threshold.at(slot) - prev)/100000.0;
+}
+unsigned int GachaBanner::pick(const std::array<unsigned int, 100> &threshold, const unsigned int v) const {
+    // v(0~99999)が入る枠を返す。
+    // 分岐なしで累積値以下の数を数えるので，まとめて抽選するときにベクトル化しやすい。
+    unsigned int slot = 0;
+    for (unsigned int i = 0; i < m_num; ++i) {
+        slot += (v >= threshold[i]);
+    }
+    return slot;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+class StoneIncome {
+    // 配布名称
+    std::string m_title;
+    // 配布日（シーズン開始からの日数）
+    unsigned int m_day;
+    // 配布石数
+    unsigned int m_stones;
+    // 繰り返し間隔（日数, 0なら1回のみ）
+    unsigned int m_interval;
+public:
+    StoneIncome(std::string title, unsigned int day, unsigned int stones, unsigned int interval=0);
+public:
+    std::string getTitle() const;
+    unsigned int getDay() const;
+    unsigned int getStones() const;
+    unsigned int getInterval() const;
+};
+StoneIncome::StoneIncome(const std::string title, const unsigned int day,
+                         const unsigned int stones, const unsigned int interval)
+        : m_title(title), m_day(day), m_stones(stones), m_interval(interval) {
+}
+std::string StoneIncome::getTitle() const {
+    return m_title;
+}
+unsigned int StoneIncome::getDay() const {
+    return m_day;
+}
+unsigned int StoneIncome::getStones() const {
+    return m_stones;
+}
+unsigned int StoneIncome::getInterval() const {
+    return m_interval;
+}
+
+class PlayerStrategy {
+    // 戦略名称
+    std::string m_title;
+    // プレイヤー比率
+    unsigned int m_weight;
+    // 狙うバナー番号（-1なら狙いなし）
+    int m_target;
+    // 狙い以外のバナーで残しておく石数
+    unsigned int m_reserve;
+    // 狙いの枠が出たらそのバナーを引くのをやめる
+    bool m_isStopOnPickUp;
+public:
+    PlayerStrategy(std::string title, unsigned int weight, int target,
+                   unsigned int reserve=0, bool isStopOnPickUp=true);
+public:
+    std::string getTitle() const;
+    unsigned int getWeight() const;
+    int getTarget() const;
+    bool isStopOnPickUp() const;
+    unsigned int getBudget(unsigned int bannerIndex, unsigned int stones) const;
+};
+PlayerStrategy::PlayerStrategy(const std::string title, const unsigned int weight, const int target,
+                               const unsigned int reserve, const bool isStopOnPickUp)
+        : m_title(title), m_weight(weight), m_target(target), m_reserve(reserve),
+          m_isStopOnPickUp(isStopOnPickUp) {
+}
+std::string PlayerStrategy::getTitle() const {
+    return m_title;
+}
+unsigned int PlayerStrategy::getWeight() const {
+    return m_weight;
+}
+int PlayerStrategy::getTarget() const {
+    return m_target;
+}
+bool PlayerStrategy::isStopOnPickUp() const {
+    return m_isStopOnPickUp;
+}
+unsigned int PlayerStrategy::getBudget(const unsigned int bannerIndex, const unsigned int stones) const {
+    // このバナーで使ってよい石数を返す。
+    if ((int)bannerIndex == m_target) {
+        // 狙いのバナーでは全部使う
+        return stones;
+    }
+    return stones > m_reserve ? stones - m_reserve : 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+template <typename Random>
+class BasicCampaignSimulator {
+    // イベント（石の配布, バナー開催）
+    struct Event {
+        enum Type { Income = 0, Banner = 1 };
+        unsigned int day;
+        Type type;
+        unsigned int index;
+        unsigned long order;
+        // 同じ日なら配布を先に，その次は登録順
+        bool operator>(const Event &e) const {
+            if (day != e.day) return day > e.day;
+            if (type != e.type) return type > e.type;
+            return order > e.order;
+        }
+    };
+    // 一括抽選するプレイヤー数
+    static const unsigned int kChunkSize = 4096;
+
+    // Gacha class（石数の計算用）
+    FGOGacha m_gacha;
+    // 乱数生成器
+    Random m_randomizer;
+    // シーズン日数
+    unsigned int m_days;
+    // タイムライン
+    std::vector<GachaBanner> m_banners;
+    std::vector<StoneIncome> m_incomes;
+    std::vector<PlayerStrategy> m_strategies;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> m_queue;
+    unsigned long m_order = 0;
+    // プレイヤー状態
+    std::vector<unsigned int> m_stones;
+    std::vector<unsigned char> m_strategy;
+    std::vector<unsigned char> m_is_got_target;
+    // 集計
+    std::vector<std::vector<unsigned long long>> m_banner_result;
+    std::vector<unsigned long long> m_banner_players;
+    std::vector<unsigned long long> m_banner_multis;
+    std::vector<unsigned long long> m_banner_hits;
+// MARK: CampaignSimulator::init
+public:
+    BasicCampaignSimulator(unsigned int days, unsigned long long seed=88675123U);
+    void addBanner(GachaBanner banner);
+    void addIncome(StoneIncome income);
+    void addStrategy(PlayerStrategy strategy);
+// MARK: CampaignSimulator::public methods
+public:
+    void run(unsigned int numOfPlayers, unsigned int initialStones);
+    std::string getResultString();
+// MARK: CampaignSimulator::private methods
+private:
+    void initPlayers(unsigned int numOfPlayers, unsigned int initialStones);
+    void push(typename Event::Type type, unsigned int day, unsigned int index);
+    void distributeIncome(unsigned int index);
+    void rollBanner(unsigned int index);
+    unsigned int getRandom();
+};
+template <typename Random>
+const unsigned int BasicCampaignSimulator<Random>::kChunkSize;
+typedef BasicCampaignSimulator<DefaultRandom> CampaignSimulator;
+
+// MARK: CampaignSimulator::init
+template <typename Random>
+BasicCampaignSimulator<Random>::BasicCampaignSimulator(const unsigned int days, const unsigned long long seed)
+        : m_randomizer(seed), m_days(days) {
+}
+template <typename Random>
+void BasicCampaignSimulator<Random>::addBanner(const GachaBanner banner) {
+    m_banners.push_back(banner);
+}
+template <typename Random>
+void BasicCampaignSimulator<Random>::addIncome(const StoneIncome income) {
+    m_incomes.push_back(income);
+}
+template <typename Random>
+void BasicCampaignSimulator<Random>::addStrategy(const PlayerStrategy strategy) {
+    m_strategies.push_back(strategy);
+}
+
+// MARK: CampaignSimulator::public methods
+template <typename Random>
+void BasicCampaignSimulator<Random>::run(const unsigned int numOfPlayers, const unsigned int initialStones) {
+    if (m_strategies.empty() || m_strategies.size() > 255) {
+        print("[CampaignSimulator] Strategies must be 1 to 255!");
+        return;
+    }
+    initPlayers(numOfPlayers, initialStones);
+
+    // タイムラインを登録
+    m_queue = std::priority_queue<Event, std::vector<Event>, std::greater<Event>>();
+    m_order = 0;
+    for (unsigned int i = 0; i < m_incomes.size(); ++i) {
+        push(Event::Income, m_incomes.at(i).getDay(), i);
+    }
+    for (unsigned int i = 0; i < m_banners.size(); ++i) {
+        push(Event::Banner, m_banners.at(i).getDay(), i);
+    }
+
+    // 日付順に処理
+    while (!m_queue.empty()) {
+        Event e = m_queue.top();
+        m_queue.pop();
+        if (e.day > m_days) {
+            break;
+        }
+        switch (e.type) {
+            case Event::Income: {
+                distributeIncome(e.index);
+                // 繰り返し配布なら次回を登録
+                const StoneIncome &income = m_incomes.at(e.index);
+                if (income.getInterval() > 0) {
+                    push(Event::Income, e.day + income.getInterval(), e.index);
+                }
+                break;
+            }
+            case Event::Banner: {
+                rollBanner(e.index);
+                break;
+            }
+        }
+    }
+}
+template <typename Random>
+std::string BasicCampaignSimulator<Random>::getResultString() {
+    std::ostringstream r;
+    r << std::fixed << std::setprecision(2);
+
+    r << "----------------------------------------\n";
+    r << "シーズン結果 (" << m_days << "日間, " << m_stones.size() << "人)\n";
+    for (unsigned int i = 0; i < m_banners.size(); ++i) {
+        const GachaBanner &banner = m_banners.at(i);
+        if (i >= m_banner_players.size()) {
+            break;
+        }
+        r << "\n[" << banner.getDay() << "日目] " << banner.getTitle() << "\n";
+        r << "引いた人数: " << m_banner_players.at(i)
+          << ", 10連回数: " << m_banner_multis.at(i) << "\n";
+        double ratio = m_stones.empty() ? 0.0 : 100.0*m_banner_hits.at(i)/m_stones.size();
+        r << banner.getProbName(banner.getTargetSlot()) << " 獲得: "
+          << m_banner_hits.at(i) << "人 (" << ratio << "%)\n";
+        for (unsigned int j = 0; j < banner.getArrayNum(); ++j) {
+            r << "  " << banner.getProbName(j) << ": " << m_banner_result.at(i).at(j) << "\n";
+        }
+    }
+
+    // 戦略ごとの集計
+    std::vector<unsigned long long> players(m_strategies.size(), 0);
+    std::vector<unsigned long long> got(m_strategies.size(), 0);
+    std::vector<unsigned long long> stones(m_strategies.size(), 0);
+    for (unsigned int p = 0; p < m_stones.size(); ++p) {
+        players.at(m_strategy[p]) += 1;
+        got.at(m_strategy[p]) += m_is_got_target[p];
+        stones.at(m_strategy[p]) += m_stones[p];
+    }
+    r << "\n";
+    for (unsigned int s = 0; s < m_strategies.size(); ++s) {
+        const PlayerStrategy &strategy = m_strategies.at(s);
+        r << "[戦略] " << strategy.getTitle() << ": " << players.at(s) << "人";
+        if (players.at(s) > 0) {
+            if (strategy.getTarget() >= 0 && strategy.getTarget() < (int)m_banners.size()) {
+                r << ", 狙い獲得率 " << 100.0*got.at(s)/players.at(s) << "%";
+            }
+            r << ", 平均残" << m_gacha.getStoneName() << " " << (double)stones.at(s)/players.at(s) << "個";
+        }
+        r << "\n";
+    }
+    r << "----------------------------------------";
+    return r.str();
+}
+
+// MARK: CampaignSimulator::private methods
+template <typename Random>
+void BasicCampaignSimulator<Random>::initPlayers(const unsigned int numOfPlayers, const unsigned int initialStones) {
+    m_stones.assign(numOfPlayers, initialStones);
+    m_is_got_target.assign(numOfPlayers, 0);
+    m_strategy.assign(numOfPlayers, 0);
+
+    // 比率に従って戦略を割り当てる
+    unsigned long long total = 0;
+    for (const PlayerStrategy &s : m_strategies) {
+        total += s.getWeight();
+    }
+    unsigned long long acc = 0;
+    unsigned int begin = 0;
+    for (unsigned int s = 0; s < m_strategies.size(); ++s) {
+        acc += m_strategies.at(s).getWeight();
+        auto end = (unsigned int)(total == 0 ? numOfPlayers : acc*numOfPlayers/total);
+        std::fill(m_strategy.begin() + begin, m_strategy.begin() + end, (unsigned char)s);
+        begin = end;
+    }
+
+    m_banner_result.assign(m_banners.size(), std::vector<unsigned long long>(100, 0));
+    m_banner_players.assign(m_banners.size(), 0);
+    m_banner_multis.assign(m_banners.size(), 0);
+    m_banner_hits.assign(m_banners.size(), 0);
+}
+template <typename Random>
+void BasicCampaignSimulator<Random>::push(const typename Event::Type type, const unsigned int day, const unsigned int index) {
+    Event e;
+    e.day = day;
+    e.type = type;
+    e.index = index;
+    e.order = m_order++;
+    m_queue.push(e);
+}
+template <typename Random>
+void BasicCampaignSimulator<Random>::distributeIncome(const unsigned int index) {
+    // 全員に配布
+    const unsigned int s = m_incomes.at(index).getStones();
+    for (unsigned int &x : m_stones) {
+        x += s;
+    }
+}
+template <typename Random>
+void BasicCampaignSimulator<Random>::rollBanner(const unsigned int index) {
+    const GachaBanner &banner = m_banners.at(index);
+    const unsigned int cost = m_gacha.getStoneConsumption(10);
+    const unsigned int target = banner.getTargetSlot();
+    std::vector<unsigned long long> &result = m_banner_result.at(index);
+
+    // このバナーを引くプレイヤーを集める
+    std::vector<unsigned int> batch;
+    std::vector<unsigned int> multis;
+    for (unsigned int p = 0; p < m_stones.size(); ++p) {
+        unsigned int n = m_strategies[m_strategy[p]].getBudget(index, m_stones[p]) / cost;
+        if (n > 0) {
+            batch.push_back(p);
+            multis.push_back(n);
+        }
+    }
+    m_banner_players.at(index) += batch.size();
+
+    // kChunkSize人ずつ，全員が1回ずつ10連を引くのを繰り返す
+    std::vector<unsigned int> values(kChunkSize*10);
+    std::vector<unsigned int> slots(kChunkSize*10);
+    std::vector<unsigned char> isHit(kChunkSize);
+    for (unsigned int begin = 0; begin < batch.size(); begin += kChunkSize) {
+        unsigned int n = std::min(kChunkSize, (unsigned int)batch.size() - begin);
+        std::vector<unsigned int> players(batch.begin() + begin, batch.begin() + begin + n);
+        std::vector<unsigned int> remains(multis.begin() + begin, multis.begin() + begin + n);
+        std::fill(isHit.begin(), isHit.end(), 0);
+        std::vector<unsigned int> alive(n);
+        std::iota(alive.begin(), alive.end(), 0);
+
+        while (!alive.empty()) {
+            const unsigned int m = (unsigned int)alive.size()*10;
+            // 乱数をまとめて生成し，まとめて枠に変換
+            for (unsigned int k = 0; k < m; ++k) {
+                values[k] = getRandom();
+            }
+            for (unsigned int k = 0; k < m; ++k) {
+                slots[k] = banner.pick(values[k]);
+            }
+
+            // 10連ごとに救済措置と集計
+            unsigned int next = 0;
+            for (unsigned int a = 0; a < alive.size(); ++a) {
+                unsigned int *h = &slots[a*10];
+                bool isRare = false;
+                for (unsigned int k = 0; k < 10; ++k) {
+                    isRare |= banner.isRare(h[k]);
+                }
+                if (!isRare) {
+                    h[0] = banner.pickReLotteryCraftEssence(getRandom());
+                }
+                bool isServant = false;
+                for (unsigned int k = 0; k < 10; ++k) {
+                    isServant |= banner.isServant(h[k]);
+                }
+                if (!isServant) {
+                    h[1] = banner.pickReLotteryServant(getRandom());
+                }
+
+                const unsigned int c = alive[a];
+                const unsigned int p = players[c];
+                bool isHitNow = false;
+                for (unsigned int k = 0; k < 10; ++k) {
+                    result[h[k]] += 1;
+                    isHitNow |= h[k] == target;
+                }
+                m_stones[p] -= cost;
+                remains[c] -= 1;
+                if (isHitNow && !isHit[c]) {
+                    isHit[c] = 1;
+                    m_banner_hits.at(index) += 1;
+                    if ((int)index == m_strategies[m_strategy[p]].getTarget()) {
+                        m_is_got_target[p] = 1;
+                    }
+                }
+                m_banner_multis.at(index) += 1;
+
+                bool isStop = isHit[c] && m_strategies[m_strategy[p]].isStopOnPickUp();
+                if (remains[c] > 0 && !isStop) {
+                    alive[next++] = c;
+                }
+            }
+            alive.resize(next);
+        }
+    }
+}
+template <typename Random>
+unsigned int BasicCampaignSimulator<Random>::getRandom() {
+    // 0~99999 (FGOGacha::getRandomと同じく小数第3位まで)
+    return getRandomRange(m_randomizer, 100000);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+// 乱数生成器の品質と速度のチェック。
+// 各生成器の検定は別スレッドで並列に行い，速度はそのあと1つずつ計測する。
+
+class RandomReport {
+public:
+    // 生成器名称
+    std::string m_name;
+    // 枠の出現頻度のカイ二乗値（有意水準0.1%の棄却限界）
+    double m_chi_square = 0;
+    double m_chi_square_limit = 0;
+    // 隣り合う乱数の系列相関（許容範囲）
+    double m_serial = 0;
+    double m_serial_limit = 0;
+    // 1秒あたりの抽選回数
+    double m_draws_per_sec = 0;
+public:
+    bool isPassed() const;
+};
+bool RandomReport::isPassed() const {
+    return m_chi_square < m_chi_square_limit && std::fabs(m_serial) < m_serial_limit;
+}
+
+template <typename Random>
+void checkRandom(const GachaBanner &banner, const unsigned long long draws, const unsigned long long seed,
+                 RandomReport &report) {
+    Random random(seed);
+    std::vector<unsigned long long> count(banner.getArrayNum(), 0);
+    double sum = 0, sumSq = 0, sumLag = 0;
+    double first = 0, prev = 0;
+    for (unsigned long long i = 0; i < draws; ++i) {
+        const unsigned int v = random.next();
+        count[banner.pick((unsigned int)(((unsigned long long)v * 100000ULL) >> 32))] += 1;
+
+        const double u = v / 4294967296.0;
+        if (i == 0) {
+            first = u;
+        } else {
+            sumLag += prev*u;
+        }
+        sum += u;
+        sumSq += u*u;
+        prev = u;
+    }
+    sumLag += prev*first;
+
+    // カイ二乗検定（Wilson-Hilferty近似で棄却限界を求める）
+    double chi = 0;
+    unsigned int df = 0;
+    for (unsigned int i = 0; i < count.size(); ++i) {
+        const double e = draws*banner.getProbability(i);
+        if (e <= 0) {
+            continue;
+        }
+        chi += (count[i] - e)*(count[i] - e)/e;
+        df += 1;
+    }
+    df = df > 1 ? df - 1 : 1;
+    const double h = 2.0/(9.0*df);
+    report.m_chi_square = chi;
+    report.m_chi_square_limit = df*std::pow(1.0 - h + 3.090*std::sqrt(h), 3);
+
+    // 系列相関（Knuth, TAOCP Vol.2 3.3.2 K）
+    const double n = (double)draws;
+    report.m_serial = (n*sumLag - sum*sum)/(n*sumSq - sum*sum);
+    report.m_serial_limit = 4.0/std::sqrt(n);
+    report.m_name = Random::getName();
+}
+template <typename Random>
+double measureRandom(const GachaBanner &banner, const unsigned long long draws, const unsigned long long seed) {
+    // rollOneと同じく，乱数を枠に変換するまでを計測する。
+    Random random(seed);
+    unsigned long long sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (unsigned long long i = 0; i < draws; ++i) {
+        sink += banner.pick(getRandomRange(random, 100000));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    // 最適化で消されないように使う
+    if (sink == 0) {
+        print("", false);
+    }
+    double sec = std::chrono::duration<double>(end - start).count();
+    return sec > 0 ? draws/sec : 0;
+}
+
+std::string benchRandom(const unsigned long long draws, const unsigned long long seed) {
+    // シードを固定して，同じ回数なら同じ結果を再現できるようにする。
+    GachaBanner banner("ピックアップ", 0, FGOGacha(true));
+
+    std::vector<RandomReport> reports(4);
+    std::vector<std::thread> threads;
+    threads.push_back(std::thread(checkRandom<XorShift128>, std::cref(banner), draws, seed, std::ref(reports[0])));
+    threads.push_back(std::thread(checkRandom<Xoshiro256StarStar>, std::cref(banner), draws, seed, std::ref(reports[1])));
+    threads.push_back(std::thread(checkRandom<Philox4x32>, std::cref(banner), draws, seed, std::ref(reports[2])));
+#ifdef __SIZEOF_INT128__
+    threads.push_back(std::thread(checkRandom<Pcg64>, std::cref(banner), draws, seed, std::ref(reports[3])));
+#else
+    reports.pop_back();
+#endif
+    for (std::thread &t : threads) {
+        t.join();
+    }
+
+    reports[0].m_draws_per_sec = measureRandom<XorShift128>(banner, draws, seed);
+    reports[1].m_draws_per_sec = measureRandom<Xoshiro256StarStar>(banner, draws, seed);
+    reports[2].m_draws_per_sec = measureRandom<Philox4x32>(banner, draws, seed);
+#ifdef __SIZEOF_INT128__
+    reports[3].m_draws_per_sec = measureRandom<Pcg64>(banner, draws, seed);
+#endif
+
+    std::ostringstream r;
+    r << "----------------------------------------\n";
+    r << "乱数チェック (" << draws << "回, シード: " << seed << ", 使用中: " << DefaultRandom::getName() << ")\n";
+    const RandomReport *best = nullptr;
+    for (const RandomReport &x : reports) {
+        r << std::left << std::setw(14) << x.m_name << std::right << std::fixed
+          << " カイ二乗 " << std::setprecision(2) << x.m_chi_square << "/" << x.m_chi_square_limit
+          << ", 系列相関 " << std::setprecision(6) << x.m_serial << "/" << x.m_serial_limit
+          << ", " << std::setprecision(1) << x.m_draws_per_sec/1.0e6 << "M回/秒"
+          << (x.isPassed() ? " [OK]" : " [NG]") << "\n";
+        if (x.isPassed() && (best == nullptr || x.m_draws_per_sec > best->m_draws_per_sec)) {
+            best = &x;
+        }
+    }
+    if (best != nullptr) {
+        r << "合格した中で最速: " << best->m_name << "\n";
+    }
+    r << "----------------------------------------";
+    return r.str();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 class UserResult {
     // 課金額
     unsigned int m_cash = 0;
@@ -546,6 +1382,7 @@ public:
     WorkOnTerminal();
     void setup();
     void loop();
+    void simulateSeason(unsigned int numOfPlayers);
 public:
     std::string input();
     std::vector<std::string> split(std::string str, std::string separator);
@@ -570,7 +1407,7 @@ void WorkOnTerminal::loop() {
         // Information
         print(m_user.getUserParameterString());
         print("\n");
-        print("課金(石数): c, ガチャ: g, リセット: r, 終了: e, ヘルプ: h");
+        print("課金(石数): c, ガチャ: g, シーズン(人数): s, 乱数チェック(回数): b, リセット: r, 終了: e, ヘルプ: h");
         std::string s = input();
 
         char c = s.front();
@@ -608,6 +1445,28 @@ void WorkOnTerminal::loop() {
                 m_user.showResult(m_user.cashing(m_gacha.roll(n)));
                 break;
             }
+            case 's': case 'S': {
+                // シーズンシミュレーション
+
+                // 人数取得
+                std::vector<std::string> rs = split(s, " ");
+                std::string rn = rs.size() > 1 ? rs[1] : "0";
+                auto n = (unsigned int)std::stoi(rn);
+
+                simulateSeason(n<=0 ? 100000 : n);
+                continue;
+            }
+            case 'b': case 'B': {
+                // 乱数チェック
+
+                // 回数取得
+                std::vector<std::string> rs = split(s, " ");
+                std::string rn = rs.size() > 1 ? rs[1] : "0";
+                auto n = (unsigned int)std::stoi(rn);
+
+                print(benchRandom(n<=0 ? 10000000 : n, 88675123U));
+                continue;
+            }
             case 'r': case 'R': {
                 // 初期化
                 print("ユーザ状態をリセットします。");
@@ -626,6 +1485,8 @@ void WorkOnTerminal::loop() {
                 print("コマンドの後にスペースと数値入力で，購入石数，ガチャ数を指定できます。");
                 print("高速10連の機能もあり，コマンド無記入+Enterで10連ガチャをすぐに引くことができます。");
                 print("c+Enterの後に，g+Enterをしてみてください。");
+                print("s+Enterで，複数バナーが続くシーズンを多人数でシミュレーションします。");
+                print("b+Enterで，乱数生成器ごとの検定と速度を表示します。");
                 continue;
             }
             default: {
@@ -635,6 +1496,32 @@ void WorkOnTerminal::loop() {
         }
     }
 }
+void WorkOnTerminal::simulateSeason(const unsigned int numOfPlayers) {
+    // 8週間のシーズン。ピックアップ2回，恒常（☆4鯖狙い），最後に本命のピックアップC。
+    CampaignSimulator campaign(56);
+    campaign.addBanner(GachaBanner("ピックアップA", 7, FGOGacha(true)));
+    campaign.addBanner(GachaBanner("ピックアップB", 21, FGOGacha(true)));
+    campaign.addBanner(GachaBanner("恒常", 35, FGOGacha(false), 1));
+    campaign.addBanner(GachaBanner("ピックアップC", 49, FGOGacha(true)));
+
+    campaign.addIncome(StoneIncome("ログインボーナス", 1, 2, 1));
+    campaign.addIncome(StoneIncome("イベント報酬", 14, 60));
+    campaign.addIncome(StoneIncome("キャンペーン配布", 42, 60));
+
+    campaign.addStrategy(PlayerStrategy("全力", 1, -1, 0, false));
+    campaign.addStrategy(PlayerStrategy("ピックアップ出るまで", 1, -1, 0, true));
+    campaign.addStrategy(PlayerStrategy("Cまで貯金", 1, 3, std::numeric_limits<unsigned int>::max()));
+    campaign.addStrategy(PlayerStrategy("90個残してC", 1, 3, 90));
+
+    print("シーズンシミュレーション: "+std::to_string(numOfPlayers)+"人");
+    auto start = std::chrono::high_resolution_clock::now();
+    campaign.run(numOfPlayers, 150);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    print(campaign.getResultString());
+    auto msec = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    print("計算時間: "+std::to_string(msec)+"ms");
+}
 std::string WorkOnTerminal::input() {
     std::string s;
     print(">> ", false);